@@ -0,0 +1,66 @@
+/*
+ *	Copyright 2026 The tkblt authors
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining
+ *	a copy of this software and associated documentation files (the
+ *	"Software"), to deal in the Software without restriction, including
+ *	without limitation the rights to use, copy, modify, merge, publish,
+ *	distribute, sublicense, and/or sell copies of the Software, and to
+ *	permit persons to whom the Software is furnished to do so, subject to
+ *	the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be
+ *	included in all copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *	EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *	MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *	NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *	LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *	OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *	WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef _BLT_ARENA_H
+#define _BLT_ARENA_H
+
+#include <stddef.h>
+
+namespace Blt {
+
+  // Bump allocator for memory that all dies together, such as the
+  // geometry of an element between two remaps. Nothing is freed
+  // individually; reset() releases everything at once. Requests that
+  // don't fit the block get a chunk of their own, and the next reset()
+  // grows the block to the high water mark, so that a steady state
+  // costs no allocations at all. A round that uses less than a quarter
+  // of the block shrinks it back.
+  class Arena {
+  protected:
+    char* block_;
+    size_t size_;
+    size_t used_;
+    size_t spilled_;
+    void* chunks_;
+    long nAllocs_;
+
+    void freeChunks();
+    void resize(size_t);
+
+  public:
+    Arena();
+    virtual ~Arena();
+
+    size_t size() {return size_ + spilled_;}
+    size_t used() {return used_ + spilled_;}
+    long nAllocs() {return nAllocs_;}
+
+    void* alloc(size_t);
+    void reset();
+    void reserve(size_t);
+
+    template <class T> T* alloc(int nn) {return (T*)alloc(nn*sizeof(T));}
+  };
+};
+
+#endif
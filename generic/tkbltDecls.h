@@ -67,6 +67,20 @@ TKBLT_STORAGE_CLASS void		Blt_InstallIndexProc(Tcl_Interp*interp,
 TKBLT_STORAGE_CLASS double		Blt_VecMin(Blt_Vector *vPtr);
 /* 19 */
 TKBLT_STORAGE_CLASS double		Blt_VecMax(Blt_Vector *vPtr);
+/* 20 */
+TKBLT_STORAGE_CLASS int		Blt_GetVectorChange(Tcl_Interp*interp,
+				Blt_VectorId clientId,
+				Blt_VectorChange *changePtr);
+/* 21 */
+TKBLT_STORAGE_CLASS Blt_VectorProducer Blt_CreateVectorProducer(Tcl_Interp*interp,
+				const char *vecName, int size);
+/* 22 */
+TKBLT_STORAGE_CLASS int		Blt_PushVectorValues(Blt_VectorProducer producer,
+				const double *values, int nValues);
+/* 23 */
+TKBLT_STORAGE_CLASS int		Blt_DrainVectorProducer(Blt_VectorProducer producer);
+/* 24 */
+TKBLT_STORAGE_CLASS void		Blt_FreeVectorProducer(Blt_VectorProducer producer);
 
 typedef struct TkbltStubs {
     int magic;
@@ -92,6 +106,11 @@ typedef struct TkbltStubs {
     void (*blt_InstallIndexProc) (Tcl_Interp*interp, const char *indexName, Blt_VectorIndexProc *procPtr); /* 17 */
     double (*blt_VecMin) (Blt_Vector *vPtr); /* 18 */
     double (*blt_VecMax) (Blt_Vector *vPtr); /* 19 */
+    int (*blt_GetVectorChange) (Tcl_Interp*interp, Blt_VectorId clientId, Blt_VectorChange *changePtr); /* 20 */
+    Blt_VectorProducer (*blt_CreateVectorProducer) (Tcl_Interp*interp, const char *vecName, int size); /* 21 */
+    int (*blt_PushVectorValues) (Blt_VectorProducer producer, const double *values, int nValues); /* 22 */
+    int (*blt_DrainVectorProducer) (Blt_VectorProducer producer); /* 23 */
+    void (*blt_FreeVectorProducer) (Blt_VectorProducer producer); /* 24 */
 } TkbltStubs;
 
 extern const TkbltStubs *tkbltStubsPtr;
@@ -146,6 +165,16 @@ extern const TkbltStubs *tkbltStubsPtr;
 	(tkbltStubsPtr->blt_VecMin) /* 18 */
 #define Blt_VecMax \
 	(tkbltStubsPtr->blt_VecMax) /* 19 */
+#define Blt_GetVectorChange \
+	(tkbltStubsPtr->blt_GetVectorChange) /* 20 */
+#define Blt_CreateVectorProducer \
+	(tkbltStubsPtr->blt_CreateVectorProducer) /* 21 */
+#define Blt_PushVectorValues \
+	(tkbltStubsPtr->blt_PushVectorValues) /* 22 */
+#define Blt_DrainVectorProducer \
+	(tkbltStubsPtr->blt_DrainVectorProducer) /* 23 */
+#define Blt_FreeVectorProducer \
+	(tkbltStubsPtr->blt_FreeVectorProducer) /* 24 */
 
 #endif /* defined(USE_TKBLT_STUBS) */
 
@@ -212,6 +212,9 @@ namespace Blt {
     double screenScale_;
     int screenMin_;
     int screenRange_;
+    TextStyle* titleStyle_;
+    TextStyle* tickStyle_;
+    TextStyle* limitsStyle_;
 
   protected:
     double niceNum(double, int);
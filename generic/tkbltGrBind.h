@@ -46,6 +46,17 @@ namespace Blt {
     ClassId newContext_;
     Pick* pickPtr_;
 
+    // Last pick and the radius around it within which it can't change
+    int pickX_;
+    int pickY_;
+    double pickRadius_;
+    ClientData pickItem_;
+    ClassId pickContext_;
+
+    // Latest motion event not yet picked, see BindMotionProc
+    int motionPending_;
+    XEvent motionEvent_;
+
   public:
     Graph* graphPtr_;
     ClientData currentItem_;
@@ -63,6 +74,9 @@ namespace Blt {
     void deleteBindings(ClientData object);
     void doEvent(XEvent*);
     void pickItem(XEvent*);
+    void invalidatePick() {pickRadius_ =0;}
+    void queueMotion(XEvent*);
+    void flushMotion();
 
     ClientData currentItem() {return currentItem_;}
   };
@@ -60,6 +60,8 @@ namespace Blt {
     double min_;
     double max_;
     int nValues_;
+    unsigned int version_;
+    int increasing_;
 
   public:
     double* values_;
@@ -68,10 +70,13 @@ namespace Blt {
     ElemValues();
     virtual ~ElemValues();
 
-    void reset();
+    virtual void reset();
     int nValues() {return nValues_;}
     double min() {return min_;}
     double max() {return max_;}
+    unsigned int version() {return version_;}
+    int isIncreasing();
+    virtual size_t memory() {return nValues_*sizeof(double);}
   };
 
   class ElemValuesSource : public ElemValues
@@ -86,6 +91,11 @@ namespace Blt {
 
   class ElemValuesVector : public ElemValues
   {
+  protected:
+    int size_;
+    int offset_;
+    int dirty_;
+
   public:
     Element* elemPtr_;
     Blt_VectorId source_;
@@ -94,9 +104,12 @@ namespace Blt {
     ElemValuesVector(Element*, const char*);
     ~ElemValuesVector();
 
+    void reset();
     int getVector();
     int fetchValues(Blt_Vector*);
+    int updateValues(Blt_Vector*, Blt_VectorChange*);
     void freeSource();
+    size_t memory() {return size_*sizeof(double);}
   };
 
   typedef struct {
@@ -121,6 +134,13 @@ namespace Blt {
     Pen* penPtr;
   } PenStyle;
 
+  // Data versions of the sources used to compute an element's extents
+  typedef struct {
+    unsigned int versions[8];
+    int xLogScale;
+    int yLogScale;
+  } ExtentsKey;
+
   typedef struct {
     Element* elemPtr;
     const char* label;
@@ -144,6 +164,26 @@ namespace Blt {
     PenOptions builtinPen;
   } ElementOptions;
 
+  // Counters of the last map and draw of an element, see graph stats
+  typedef struct {
+    long mapped;
+    long drawn;
+    long traces;
+    long allocs;
+  } ElementStats;
+
+  // Bytes held by an element, see graph memory. The mapped geometry of a
+  // line element is part of its arena.
+  typedef struct {
+    size_t values;
+    size_t symbols;
+    size_t traces;
+    size_t fill;
+    size_t errorBars;
+    size_t active;
+    size_t arena;
+  } ElementMemory;
+
   class Element {
   protected:
     Tk_OptionTable optionTable_;
@@ -152,6 +192,19 @@ namespace Blt {
     double xRange_;
     double yRange_;
 
+    Region2d extents_;
+    ExtentsKey extentsKey_;
+    int extentsValid_;
+
+    // Axis limits and their screen positions at the last map, used to
+    // detect a pure translation of the view
+    Point2d mapMin_;
+    Point2d mapMax_;
+    Point2d screenMin_;
+    Point2d screenMax_;
+    Region2d mapExts_;
+    int mapped_;
+
   public:
     Graph* graphPtr_;
     const char* name_;
@@ -162,12 +215,19 @@ namespace Blt {
     int* activeIndices_;
     int active_;		
     int labelActive_;
+    int stride_;
+    ElementStats stats_;
 
     ChainLink* link;
 
   protected:
     double FindElemValuesMinimum(ElemValues*, double);
     PenStyle** StyleMap();
+    void getExtentsKey(ExtentsKey*);
+    virtual int cacheExtents() {return 1;}
+    virtual int pan(double, double) {return 0;}
+    int panOffset(Point2d*);
+    void saveView();
 
   public:
     Element(Graph*, const char*, Tcl_HashEntry*);
@@ -183,12 +243,16 @@ namespace Blt {
     virtual void print(PSOutput*) =0;
     virtual void printActive(PSOutput*) =0;
     virtual void printSymbol(PSOutput*, double, double, int) =0;
+    virtual void memory(ElementMemory*);
 
     virtual ClassId classId() =0;
     virtual const char* className() =0;
     virtual const char* typeName() =0;
 
     void freeStylePalette (Chain*);
+    void cachedExtents(Region2d*);
+    void invalidateExtents() {extentsValid_ =0;}
+    void mapView(int);
 
     Tk_OptionTable optionTable() {return optionTable_;}
     void* ops() {return ops_;}
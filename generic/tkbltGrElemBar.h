@@ -78,6 +78,7 @@ namespace Blt {
     BarPen* activePenPtr;
     BarPen* normalPenPtr;
     BarPenOptions builtinPen;
+    int aggregate;
 
     // derived
     double barWidth;
@@ -88,6 +89,7 @@ namespace Blt {
   protected:
     BarPen* builtinPenPtr;
     int* barToData_;
+    int* barRange_;
     Rectangle* bars_;
     int* activeToData_;
     Rectangle* activeRects_;
@@ -107,6 +109,7 @@ namespace Blt {
     void drawValues(Drawable, BarPen*, Rectangle*, int, int*);
     void printSegments(PSOutput*, BarPen*, Rectangle*, int);
     void printValues(PSOutput*, BarPen*, Rectangle*, int, int*);
+    int cacheExtents();
 
   public:
     BarElement(Graph*, const char*, Tcl_HashEntry*);
@@ -126,6 +129,7 @@ namespace Blt {
     void print(PSOutput*);
     void printActive(PSOutput*);
     void printSymbol(PSOutput*, double, double, int);
+    void memory(ElementMemory*);
   };
 };
 
@@ -32,6 +32,7 @@
 
 #include <tk.h>
 
+#include "tkbltArena.h"
 #include "tkbltGraph.h"
 #include "tkbltGrElem.h"
 #include "tkbltGrPenLine.h"
@@ -51,9 +52,11 @@ namespace Blt {
     int *map;
   } GraphPoints;
 
+  // A trace is a span of the element's trace point array
   typedef struct {
     int start;
-    GraphPoints screenPts;
+    int offset;
+    int length;
   } bltTrace;
 
   typedef struct {
@@ -104,6 +107,7 @@ namespace Blt {
 
   protected:
     LinePen* builtinPenPtr;
+    Arena* arena_;
     Smoothing smooth_;
     Point2d *fillPts_;
     int nFillPts_;
@@ -113,7 +117,11 @@ namespace Blt {
     GraphSegments yeb_;
     int symbolInterval_;
     int symbolCounter_;
-    Chain* traces_;
+    GraphPoints tracePts_;
+    int tracePtsSize_;
+    bltTrace* traces_;
+    int nTraces_;
+    int tracesSize_;
 
     void drawCircle(Display*, Drawable, LinePen*, int, Point2d*, int);
     void drawSquare(Display*, Drawable, LinePen*, int, Point2d*, int);
@@ -134,11 +142,16 @@ namespace Blt {
     void mergePens(LineStyle**);
     int outCode(Region2d*, Point2d*);
     int clipSegment(Region2d*, int, int, Point2d*, Point2d*);
+    void reserveTraces(int);
     void saveTrace(int, int, MapInfo*);
     void freeTraces();
-    void mapTraces(MapInfo*);
+    void mapTraces(MapInfo*, Region2d*);
     void mapFillArea(MapInfo*);
-    void mapErrorBars(LineStyle**);
+    void mapErrorBars(LineStyle**, Region2d*, int, int, 
+		      GraphSegments*, GraphSegments*);
+    int pan(double, double);
+    void panErrorBars(GraphSegments*, GraphSegments*, double, double, 
+		      Region2d*);
     void reset();
     int closestTrace();
     void closestPoint(ClosestSearch*);
@@ -178,6 +191,7 @@ namespace Blt {
     void print(PSOutput*);
     void printActive(PSOutput*);
     void printSymbol(PSOutput*, double, double, int);
+    void memory(ElementMemory*);
   };
 };
 
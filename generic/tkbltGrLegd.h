@@ -61,6 +61,9 @@ namespace Blt {
 #define SELECT_SORTED		(1<<27)
 #define SELECT_TOGGLE		(SELECT_SET | SELECT_CLEAR)
 
+  // The whole legend pixmap has to be redrawn, not just the dirty entries
+#define REDRAW_LEGEND		(1<<28)
+
   typedef enum {
     SELECT_MODE_SINGLE, SELECT_MODE_MULTIPLE
   } SelectMode;
@@ -112,6 +115,13 @@ namespace Blt {
 
     GC focusGC_;
     Tcl_HashTable selectTable_;
+    TextStyle* titleStyle_;
+    TextStyle* style_;
+    Pixmap pixmap_;
+    int pixmapWidth_;
+    int pixmapHeight_;
+    Region2d drawn_;
+    Chain* dirty_;
 
   public:
     Graph* graphPtr_;
@@ -137,6 +147,8 @@ namespace Blt {
 
   protected:
     void setOrigin();
+    int isOpaque();
+    void drawEntry(Drawable, Element*, int, int, int);
     Element* getNextRow(Element*);
     Element* getNextColumn(Element*);
     Element* getPreviousRow(Element*);
@@ -164,6 +176,10 @@ namespace Blt {
     void clearSelection();
     int entryIsSelected(Element*);
 
+    void invalidate();
+    void invalidateEntry(Element*);
+    size_t memory();
+
     void* ops() {return ops_;}
     Tk_OptionTable optionTable() {return optionTable_;}
 
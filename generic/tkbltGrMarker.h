@@ -72,7 +72,15 @@ namespace Blt {
     unsigned int flags;		
     int clipped_;
 
+    // Bookkeeping for the graph's marker index
+    Region2d bbox_;
+    int indexRange_[4];
+    int order_;
+    unsigned int searchId_;
+
   protected:
+    void clearBBox();
+    void addToBBox(Point2d*);
     double HMap(Axis*, double);
     double VMap(Axis*, double);
     Point2d mapPoint(Point2d*, Axis*, Axis*);
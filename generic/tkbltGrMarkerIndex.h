@@ -0,0 +1,70 @@
+/*
+ *	Copyright 2026 The tkblt authors
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining
+ *	a copy of this software and associated documentation files (the
+ *	"Software"), to deal in the Software without restriction, including
+ *	without limitation the rights to use, copy, modify, merge, publish,
+ *	distribute, sublicense, and/or sell copies of the Software, and to
+ *	permit persons to whom the Software is furnished to do so, subject to
+ *	the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be
+ *	included in all copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *	EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *	MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *	NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *	LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *	OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *	WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef __BltGrMarkerIndex_h__
+#define __BltGrMarkerIndex_h__
+
+#include "tkbltGrMisc.h"
+
+namespace Blt {
+  class Graph;
+  class Marker;
+
+  typedef struct {
+    Marker** markers;
+    int num;
+    int size;
+  } MarkerCell;
+
+  // Uniform grid over the window holding the screen bounding boxes of the
+  // mapped markers, so that drawing and picking only look at the markers
+  // near the region of interest. Boxes that stick out of the window are
+  // clamped to the border cells.
+  class MarkerIndex {
+  protected:
+    Graph* graphPtr_;
+    MarkerCell* cells_;
+    int nColumns_;
+    int nRows_;
+    int orderValid_;
+    unsigned int searchId_;
+    Marker** found_;
+    int foundSize_;
+
+  protected:
+    void cellRange(Region2d*, int*);
+    void renumber();
+
+  public:
+    MarkerIndex(Graph*);
+    virtual ~MarkerIndex();
+
+    void reset(int, int);
+    void insert(Marker*);
+    void remove(Marker*);
+    void invalidateOrder() {orderValid_ =0;}
+    int search(Region2d*, Marker***);
+  };
+};
+
+#endif
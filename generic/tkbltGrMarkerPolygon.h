@@ -56,14 +56,23 @@ namespace Blt {
   class PolygonMarker : public Marker {
   protected:
     Point2d *screenPts_;
+    int nScreenPts_;
     GC outlineGC_;
     GC fillGC_;
     Point2d *fillPts_;
     int nFillPts_;
     Segment2d *outlinePts_;
     int nOutlinePts_;
+    Region2d worldBBox_;
+    int nBands_;
+    double bandHeight_;
+    int* bandEdges_;
+    int* edges_;
 
   protected:
+    int screenBBox(Region2d*);
+    void makeEdgeIndex();
+    void freeGeometry();
     int configure();
     void draw(Drawable);
     void map();
@@ -60,6 +60,7 @@ namespace Blt {
     int height_;
     GC fillGC_;
     Point2d outline_[5];
+    TextStyle* ts_;
 
   protected:
     int configure();
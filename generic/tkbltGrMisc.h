@@ -55,6 +55,10 @@ using namespace std;
 #define LAYOUT          (1<<6)
 #define	MAP_MARKERS     (1<<7)
 #define	CACHE           (1<<8)
+#define	PAN             (1<<9)
+#define	REDRAW_DELAYED  (1<<10)
+#define	PROGRESS_PENDING (1<<11)
+#define	APPENDED        (1<<12)
 
 #define MARGIN_NONE	-1
 #define MARGIN_BOTTOM	0		/* x */
@@ -113,6 +117,8 @@ namespace Blt {
 			  int nInputPts, Point2d *outputPts);
   extern int lineRectClip(Region2d *regionPtr, Point2d *p, Point2d *q);
   extern Point2d getProjection (int x, int y, Point2d *p, Point2d *q);
+  extern long maxRequestSize(Display* display, size_t elemSize);
+  extern double monotonicTime();
 };
 
 #endif
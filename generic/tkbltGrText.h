@@ -46,12 +46,29 @@ namespace Blt {
     Tk_Justify justify;
   } TextStyleOptions;
 
+  // Layout and sizes of a string, cached by the text style
+  typedef struct {
+    Tk_TextLayout layout;	/* NULL until the string is drawn */
+    int width;			/* Size of the layout */
+    int height;
+    int extWidth;		/* Extents of the string, -1 until measured */
+    int extHeight;
+    double angle;		/* Angle of the rotated size */
+    double rotWidth;
+    double rotHeight;
+  } TextLayout;
+
   class TextStyle {
   protected:
     Graph* graphPtr_;
     void* ops_;
     GC gc_;
     int manageOptions_;
+    Tk_Font gcFont_;
+    XColor* gcColor_;
+    Tcl_HashTable layoutTable_;
+    Tk_Font layoutFont_;
+    Tk_Justify layoutJustify_;
 
   public:
     int xPad_;
@@ -59,7 +76,9 @@ namespace Blt {
 
   protected:
     void resetStyle();
-    Point2d rotateText(int, int, int, int);
+    Point2d rotateText(int, int, int, int, double, double);
+    TextLayout* getLayout(const char*, const char**);
+    void freeLayouts();
 
   public:
     TextStyle(Graph*);
@@ -67,6 +86,7 @@ namespace Blt {
     virtual ~TextStyle();
 
     void* ops() {return ops_;}
+    void reset();
     void drawText(Drawable, const char*, int, int);
     void drawText(Drawable, const char*, double, double);
     void drawTextBBox(Drawable, const char*, int, int, int*, int*);
@@ -48,6 +48,7 @@ namespace Blt {
   class Crosshairs;
   class Element;
   class Marker;
+  class MarkerIndex;
   class Legend;
   class Pen;
   class Postscript;
@@ -56,8 +57,14 @@ namespace Blt {
   class Pick {
   public:
     virtual ClientData pickEntry(int, int, ClassId*) =0;
+    // Radius around the last pick within which it returns the same entry
+    virtual double pickRadius() {return 0;}
   };
 
+#define SEARCH_X	0
+#define SEARCH_Y	1
+#define SEARCH_BOTH	2
+
   typedef struct {
     int halo;
     int mode;
@@ -71,6 +78,21 @@ namespace Blt {
     double dist;
   } ClosestSearch;
 
+  // Phases of a redraw timed by graph stats
+  typedef enum {
+    PHASE_RESET_AXES, PHASE_LAYOUT, PHASE_MAP_AXES, PHASE_MAP_ELEMENTS,
+    PHASE_MAP_MARKERS, PHASE_DRAW_AXES, PHASE_DRAW_ELEMENTS,
+    PHASE_DRAW_LEGEND, PHASE_DRAW_MARKERS, PHASE_COPY, PHASE_FRAME,
+    NUM_PHASES
+  } Phase;
+
+  typedef struct {
+    long calls;
+    double total;
+    double last;
+    double max;
+  } PhaseStats;
+
   typedef struct {
     int width;
     int height;
@@ -120,6 +142,12 @@ namespace Blt {
     int reqWidth;
     int reqPlotWidth;
     int reqPlotHeight;
+    double maxFps;
+    int minRedrawInterval;
+    int progressive;
+    int stats;
+    Tcl_Obj* statsCmdObjPtr;
+    int coalesceMotion;
   } GraphOptions;
 
   class Graph : public Pick {
@@ -138,6 +166,7 @@ namespace Blt {
     Component axes_;
     Component elements_;
     Component markers_;
+    MarkerIndex* markerIndex_;
     Tcl_HashTable penTable_;
     BindTable* bindTable_;
     Chain* axisChain_[4];
@@ -169,6 +198,16 @@ namespace Blt {
     Pixmap cache_;
     int cacheWidth_;
     int cacheHeight_;
+    double pickRadius_;
+    int redrawInterval_;
+    Tcl_TimerToken redrawTimer_;
+    Tcl_Time redrawTime_;
+    long framesDrawn_;
+    long redrawsMerged_;
+    int progressLevel_;
+    int progressElem_;
+    int timing_;
+    PhaseStats phases_[NUM_PHASES];
 
   protected:
     void layoutGraph();
@@ -182,6 +221,7 @@ namespace Blt {
     void destroyElements();
     void configureElements();
     virtual void mapElements();
+    int progressStride(Element*, int);
     void drawElements(Drawable);
     void drawActiveElements(Drawable);
     void printElements(PSOutput*);
@@ -210,6 +250,16 @@ namespace Blt {
     void map();
     void draw();
     void eventuallyRedraw();
+    void cancelRedraw();
+    void refine();
+    void cancelProgress();
+
+    double startPhase() {return timing_ ? monotonicTime() : 0;}
+    void endPhase(Phase, double);
+    void resetStats();
+    Tcl_Obj* statsObj(Tcl_Interp*, int);
+    size_t pixmapBytes(int, int);
+    Tcl_Obj* memoryObj(Tcl_Interp*);
     int print(const char*, PSOutput*);
     void extents(Region2d*);
     int invoke(const Ensemble*, int, int, Tcl_Obj* const []);
@@ -244,6 +294,8 @@ namespace Blt {
 
     const char** getTags(ClientData, ClassId, int*);
     ClientData pickEntry(int, int, ClassId*);
+    double pickRadius() {return pickRadius_;}
+    double markerClearance(int, int, double);
 
     void drawSegments(Drawable, GC, Segment2d*, int);
     void setDashes(GC, Dashes*);
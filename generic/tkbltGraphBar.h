@@ -81,6 +81,12 @@ namespace Blt {
     int reqWidth;
     int reqPlotWidth;
     int reqPlotHeight;
+    double maxFps;
+    int minRedrawInterval;
+    int progressive;
+    int stats;
+    Tcl_Obj* statsCmdObjPtr;
+    int coalesceMotion;
 
     // bar graph
     int barMode;
@@ -61,6 +61,12 @@ namespace Blt {
     int reqWidth;
     int reqPlotWidth;
     int reqPlotHeight;
+    double maxFps;
+    int minRedrawInterval;
+    int progressive;
+    int stats;
+    Tcl_Obj* statsCmdObjPtr;
+    int coalesceMotion;
   } LineGraphOptions;
 
   class LineGraph : public Graph {
@@ -25,6 +25,11 @@ const TkbltStubs tkbltStubs = {
     Blt_InstallIndexProc, /* 17 */
     Blt_VecMin, /* 18 */
     Blt_VecMax, /* 19 */
+    Blt_GetVectorChange, /* 20 */
+    Blt_CreateVectorProducer, /* 21 */
+    Blt_PushVectorValues, /* 22 */
+    Blt_DrainVectorProducer, /* 23 */
+    Blt_FreeVectorProducer, /* 24 */
 };
 
 /* !END!: Do not edit above this line. */
@@ -28,6 +28,8 @@
  */
 
 
+#include <limits.h>
+
 #include "tkbltChain.h"
 #include "tkbltVector.h"
 
@@ -70,6 +72,17 @@
 #define UPDATE_RANGE		(1<<9)	/* The data of the vector has changed.
 					 * Update the min and max limits when
 					 * they are needed */
+#define PACK_PENDING		(1<<10)	/* The values are narrowed to the
+					 * storage type of the vector at the
+					 * next idle point */
+#define NOTIFY_BATCHED		(1<<11)	/* The vector was updated inside a
+					 * batch. Its clients are notified at
+					 * the end of the batch. */
+#define NOTIFY_DELAYED		(1<<12)	/* A timer notifying the clients is
+					 * pending, see notifyInterval. */
+
+#define VECTOR_MAX_PARTS	16	/* Maximum number of threads sharing
+					 * a computation over the values */
 
 #define FindRange(array, first, last, min, max) \
   {						\
@@ -94,12 +107,49 @@ namespace Blt {
     double y;
   } Point2d;
 
+  // Types the values of an idle vector are stored as
+  typedef enum {
+    VECTOR_R8, VECTOR_R4, VECTOR_I4, VECTOR_I2, VECTOR_U1
+  } VectorType;
+
+  // Value storage shared by vectors holding the same values. The first
+  // vector to change them makes a private copy.
+  typedef struct {
+    int refCount;		/* Number of vectors using the storage */
+    double* base;		/* Start of the storage (malloc-ed) */
+  } VectorBuffer;
+
+  // Moments of the selected range of a vector, computed in a single pass
+  typedef struct {
+    int count;			/* Number of values */
+    double sum;
+    double mean;
+    double m2, m3, m4;		/* Sums of the 2nd, 3rd and 4th powers of
+				 * the deviations from the mean */
+    double min, max;
+  } VectorStats;
+
+  // Bytes held by a vector, see vector memory
+  typedef struct {
+    size_t values;		/* Storage of the values owned by the
+				 * vector */
+    size_t unused;		/* Part of it beyond the length */
+    size_t shared;		/* Storage shared with other vectors */
+    size_t packed;		/* Values narrowed to the storage type */
+    size_t cache;		/* Cached statistics */
+  } VectorMemory;
+
+  // Computes part of the values, from first to first+length-1
+  typedef void (VectorPartProc)(ClientData clientData, int part, int first,
+				int length);
+
   typedef struct {
     Tcl_HashTable vectorTable;	/* Table of vectors */
     Tcl_HashTable mathProcTable; /* Table of vector math functions */
     Tcl_HashTable indexProcTable;
     Tcl_Interp* interp;
     unsigned int nextId;
+    int batchLevel;		/* Nesting level of "vector batch" scripts */
   } VectorInterpData;
 
   typedef struct {
@@ -145,6 +195,43 @@ namespace Blt {
     int flush;
     int first, last;		/* Selected region of vector. This is used
 				 * mostly for the math routines */
+    int ringSize;		/* If greater than zero, the vector only keeps
+				 * its last ringSize values. */
+    int ringOffset;		/* Number of values evicted from the front of
+				 * the array. valueArr points this far into
+				 * the allocated storage, which is compacted
+				 * only when the array runs out of room. */
+    int type;			/* Storage type of the values, see
+				 * VectorType. Vectors of other types than
+				 * VECTOR_R8 are packed when idle. */
+    void* packedArr;		/* Values narrowed to the storage type
+				 * (malloc-ed). While the vector is packed,
+				 * valueArr is NULL. */
+    VectorBuffer* shared;	/* If non-NULL, valueArr points into storage
+				 * shared with other vectors. It must be
+				 * unshared before the values are changed. */
+    int changedFirst, changedLast; /* Range of values changed since the
+				 * clients were last notified. The indices
+				 * don't account for evicted values. */
+    int nEvicted;		/* Number of values evicted from the front
+				 * since the clients were last notified */
+    int notifiedLength;		/* Length of the vector when the clients
+				 * were last notified */
+    int notifiedDirty;		/* Dirty counter of the vector when the
+				 * clients were last notified */
+    Blt_VectorChange change;	/* Change the clients were last notified
+				 * of */
+    int notifyInterval;		/* If greater than zero, the minimum time in
+				 * milliseconds between notifications */
+    Tcl_TimerToken notifyTimer; /* Token for the timer of a delayed
+				 * notification */
+    Tcl_Time notifyTime;	/* Time the clients were last notified */
+    VectorStats* statsPtr;	/* Cached statistics of the values from
+				 * statsFirst to statsLast (malloc-ed). They
+				 * are valid while the dirty counter is still
+				 * statsDirty. */
+    int statsFirst, statsLast;
+    int statsDirty;
   } Vector;
 
   extern const char* Itoa(int value);
@@ -159,9 +246,22 @@ namespace Blt {
 				  int flags);
   extern int Vec_SetLength(Tcl_Interp* interp, Vector *vPtr, int length);
   extern int Vec_SetSize(Tcl_Interp* interp, Vector *vPtr, int size);
+  extern int Vec_SetRingSize(Tcl_Interp* interp, Vector *vPtr, int ringSize);
+  extern size_t Vec_Compact(Vector *vPtr);
+  extern void Vec_GetMemory(Vector *vPtr, VectorMemory *memPtr);
+  extern int Vec_GetType(Tcl_Interp* interp, const char *string, int *typePtr);
+  extern const char* Vec_NameOfType(int type);
+  extern int Vec_SetType(Tcl_Interp* interp, Vector *vPtr, int type);
+  extern void Vec_Pack(Vector *vPtr);
+  extern int Vec_Unpack(Tcl_Interp* interp, Vector *vPtr);
+  extern double Vec_GetValue(Vector *vPtr, int index);
+  extern int Vec_Unshare(Tcl_Interp* interp, Vector *vPtr);
   extern void Vec_FlushCache(Vector *vPtr);
   extern void Vec_UpdateRange(Vector *vPtr);
   extern void Vec_UpdateClients(Vector *vPtr);
+  extern void Vec_UpdateClientsRange(Vector *vPtr, int first, int last);
+  extern void Vec_BeginBatch(VectorInterpData *dataPtr);
+  extern void Vec_EndBatch(VectorInterpData *dataPtr);
   extern void Vec_Free(Vector *vPtr);
   extern Vector* Vec_New(VectorInterpData *dataPtr);
   extern int Vec_MapVariable(Tcl_Interp* interp, Vector *vPtr, 
@@ -185,6 +285,10 @@ namespace Blt {
   extern size_t *Vec_SortMap(Vector **vectors, int nVectors);
   extern double Vec_Max(Vector *vecObjPtr);
   extern double Vec_Min(Vector *vecObjPtr);
+  extern void Vec_GetStats(Vector *vPtr, VectorStats *statsPtr);
+  extern int Vec_NumParts(int length, int minPartSize);
+  extern void Vec_RunParts(VectorPartProc *proc, ClientData clientData,
+			   int length, int nParts);
   extern int ExprVector(Tcl_Interp* interp, char *string, Blt_Vector *vector);
   
   extern Tcl_ObjCmdProc Vec_InstCmd;
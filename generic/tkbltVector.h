@@ -55,6 +55,8 @@ typedef enum {
 
 typedef struct _Blt_VectorId *Blt_VectorId;
 
+typedef struct _Blt_VectorProducer *Blt_VectorProducer;
+
 typedef void (Blt_VectorChangedProc)(Tcl_Interp* interp, ClientData clientData,
 				     Blt_VectorNotify notify);
 
@@ -68,6 +70,27 @@ typedef struct {
 
 } Blt_Vector;
 
+/*
+ * Values of the vector changed since the clients were previously notified.
+ * The change applies to a client that last saw the vector when its dirty
+ * counter was since. Others must fetch all the values.
+ */
+typedef struct {
+  int since;			/* Dirty counter of the vector before the
+				 * change */
+  int dirty;			/* Dirty counter of the vector after the
+				 * change */
+  int first, last;		/* Range of the values changed or added. It is
+				 * empty (first > last) if values were only
+				 * removed from the end */
+  int nEvicted;		/* Number of values removed from the front of
+				 * a vector with a ring size. The other values
+				 * moved down as many indices */
+  int appendOnly;		/* If non-zero, no values were changed
+				 * besides the ones appended from first and
+				 * the ones evicted from the front */
+} Blt_VectorChange;
+
 typedef double (Blt_VectorIndexProc)(Blt_Vector * vecPtr);
 
 typedef enum {
@@ -131,6 +154,14 @@ extern "C" {
 				   Blt_VectorIndexProc * procPtr);
   TKBLT_STORAGE_CLASS double Blt_VecMin(Blt_Vector *vPtr);
   TKBLT_STORAGE_CLASS double Blt_VecMax(Blt_Vector *vPtr);
+  TKBLT_STORAGE_CLASS int Blt_GetVectorChange(Tcl_Interp* interp, Blt_VectorId clientId,
+				  Blt_VectorChange *changePtr);
+  TKBLT_STORAGE_CLASS Blt_VectorProducer Blt_CreateVectorProducer(Tcl_Interp* interp,
+				  const char *vecName, int size);
+  TKBLT_STORAGE_CLASS int Blt_PushVectorValues(Blt_VectorProducer producer,
+				  const double *values, int nValues);
+  TKBLT_STORAGE_CLASS int Blt_DrainVectorProducer(Blt_VectorProducer producer);
+  TKBLT_STORAGE_CLASS void Blt_FreeVectorProducer(Blt_VectorProducer producer);
 #ifdef __cplusplus
 }
 #endif
@@ -1,3 +1,4 @@
+source vector.test
 source linegraph.tcl
 source lineelement.tcl
 source linepen.tcl
@@ -12,6 +12,7 @@ $bltgr element activate data3
 puts stderr "Testing Bar Element..."
 
 bltTest3 $bltgr element data3 -activepen foo $dops
+bltTest3 $bltgr element data2 -aggregate 2 $dops
 bltTest3 $bltgr element data2 -background yellow $dops
 bltTest3 $bltgr element data2 -barwidth 1 $dops
 bltTest3 $bltgr element data2 -bd 4 $dops
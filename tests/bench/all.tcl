@@ -0,0 +1,17 @@
+# Runs the benchmarks and prints their results on stdout, see bench.tcl
+#   all.tcl ?-sizes sizes? ?-repeat count? ?-load script?
+
+set benchDir [file dirname [file normalize [info script]]]
+source [file join $benchDir bench.tcl]
+bltBenchArgs $argv
+
+package require Tk
+package require tkblt
+
+bltBenchPlatform
+source [file join $benchDir vector.tcl]
+source [file join $benchDir line.tcl]
+source [file join $benchDir bar.tcl]
+
+puts stderr "done"
+exit
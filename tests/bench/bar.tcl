@@ -0,0 +1,34 @@
+puts stderr "Benchmarking bar elements..."
+
+set g [blt::barchart .bar -width 800 -height 600]
+pack $g -expand yes -fill both
+update
+
+set benchElems {a b c d}
+foreach n $benchSizes {
+    blt::vector create x y
+    bltBenchData x y $n
+    foreach elem $benchElems {
+	$g element create $elem -xdata x -ydata y
+    }
+    $g redraw
+
+    foreach mode {normal stacked aligned overlap} {
+	bltBenchPhase bar.map.$mode $n $g mapelements {$g redraw} \
+	    {$g configure -barmode $mode}
+    }
+    $g configure -barmode stacked
+    bltBenchPhase bar.draw $n $g drawelements {$g redraw}
+
+    set cx [expr {[winfo width $g]/2}]
+    set cy [expr {[winfo height $g]/2}]
+    bltBench bar.closest $n {$g element closest $cx $cy}
+    bltBench bar.postscript $n {$g postscript output}
+
+    foreach elem $benchElems {
+	$g element delete $elem
+    }
+    blt::vector destroy x y
+}
+
+destroy $g
@@ -0,0 +1,88 @@
+# Benchmark support. Each result is printed on stdout as one line, which
+# is a dictionary:
+#   bench <name> points <n> iterations <n> usec <mean> min <min>
+# Progress goes to stderr, so that stdout can be saved and compared
+# between releases.
+
+if {![info exists benchSizes]} {
+    set benchSizes {1000 100000 1000000}
+}
+if {![info exists benchRepeat]} {
+    set benchRepeat 5
+}
+
+proc bltBenchArgs {argv} {
+    global benchSizes benchRepeat
+
+    foreach {flag value} $argv {
+	switch -- $flag {
+	    -sizes {set benchSizes $value}
+	    -repeat {set benchRepeat $value}
+	    -load {uplevel #0 $value}
+	    default {error "unknown flag \"$flag\": should be -sizes, -repeat or -load"}
+	}
+    }
+}
+
+proc bltBenchResult {name points iterations usec min} {
+    puts [list bench $name points $points iterations $iterations \
+	      usec [format %.1f $usec] min [format %.1f $min]]
+    flush stdout
+}
+
+# Runs the setup and the script repeat times, timing only the script
+proc bltBench {name points script {setup {}}} {
+    global benchRepeat
+
+    puts stderr "  $name $points"
+    set total 0
+    set min {}
+    for {set ii 0} {$ii < $benchRepeat} {incr ii} {
+	uplevel 1 $setup
+	set usec [lindex [uplevel 1 [list time $script]] 0]
+	set total [expr {$total + $usec}]
+	if {$min eq {} || $usec < $min} {
+	    set min $usec
+	}
+    }
+    bltBenchResult $name $points $benchRepeat \
+	[expr {double($total)/$benchRepeat}] $min
+}
+
+# Reports the time of a phase of the graph, see graph stats. The script
+# must redraw the graph once.
+proc bltBenchPhase {name points graph phase script {setup {}}} {
+    global benchRepeat
+
+    puts stderr "  $name $points"
+    $graph configure -stats yes
+    set total 0
+    set min {}
+    for {set ii 0} {$ii < $benchRepeat} {incr ii} {
+	uplevel 1 $setup
+	$graph stats -reset
+	uplevel 1 $script
+	set usec [dict get [$graph stats] phases $phase total]
+	set total [expr {$total + $usec}]
+	if {$min eq {} || $usec < $min} {
+	    set min $usec
+	}
+    }
+    $graph configure -stats no
+    bltBenchResult $name $points $benchRepeat \
+	[expr {double($total)/$benchRepeat}] $min
+}
+
+# Fills the vectors with a synthetic noisy signal of n points
+proc bltBenchData {xName yName n} {
+    $xName seq 0 [expr {$n-1}] $n
+    $yName expr "sin($xName/1000.0)*100.0 + random($xName)*10.0"
+}
+
+proc bltBenchPlatform {} {
+    global tcl_platform
+
+    puts [list bench platform tkblt [package present tkblt] \
+	      tcl [info patchlevel] os $tcl_platform(os) \
+	      machine $tcl_platform(machine)]
+}
@@ -0,0 +1,29 @@
+puts stderr "Benchmarking line elements..."
+
+set g [blt::graph .line -width 800 -height 600]
+pack $g -expand yes -fill both
+update
+
+foreach n $benchSizes {
+    blt::vector create x y
+    bltBenchData x y $n
+    $g element create line -xdata x -ydata y -symbol none
+    $g redraw
+
+    foreach mode {linear step cubic quadratic catrom} {
+	bltBenchPhase line.map.$mode $n $g mapelements {$g redraw} \
+	    {$g element configure line -smooth $mode}
+    }
+    $g element configure line -smooth linear
+    bltBenchPhase line.draw $n $g drawelements {$g redraw}
+
+    set cx [expr {[winfo width $g]/2}]
+    set cy [expr {[winfo height $g]/2}]
+    bltBench line.closest $n {$g element closest $cx $cy}
+    bltBench line.postscript $n {$g postscript output}
+
+    $g element delete line
+    blt::vector destroy x y
+}
+
+destroy $g
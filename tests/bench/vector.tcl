@@ -0,0 +1,29 @@
+puts stderr "Benchmarking vectors..."
+
+set benchFile [file join [pwd] bench.bin]
+
+foreach n $benchSizes {
+    blt::vector create x y z re
+    bltBenchData x y $n
+
+    bltBench vector.expr $n {z expr {x*2.0 + y*y/3.0 - sin(y)}}
+    bltBench vector.sort $n {z sort} {z expr {y}}
+    bltBench vector.stats $n {z stats} {z expr {y}}
+    bltBench vector.fft $n {y fft re}
+
+    set f [open $benchFile w]
+    fconfigure $f -translation binary
+    set block [binary format d* [y range 0 [expr {($n < 1024) ? $n-1 : 1023}]]]
+    puts -nonewline $f [string repeat $block [expr {($n+1023)/1024}]]
+    close $f
+    bltBench vector.binread $n {
+	set f [open $benchFile r]
+	fconfigure $f -translation binary
+	z binread $f $n -format r8
+	close $f
+    } {z length 0}
+
+    blt::vector destroy x y z re
+}
+
+file delete $benchFile
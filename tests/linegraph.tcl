@@ -15,6 +15,7 @@ bltTest $bltgr -borderwidth 50 $dops
 bltTest $bltgr -bottommargin 50 $dops
 #bltTest $bltgr -bufferelements $dops
 #bltTest $bltgr -buffergraph $dops
+bltTest $bltgr -coalescemotion yes $dops
 bltTest $bltgr -cursor cross $dops
 bltTest $bltgr -fg blue $dops
 bltTest $bltgr -font {times 36 bold italic} $dops
@@ -30,14 +31,18 @@ bltTest $bltgr -justify center $dops
 bltTest $bltgr -justify right $dops
 bltTest $bltgr -leftmargin 50 $dops
 bltTest $bltgr -lm 50 $dops
+bltTest $bltgr -maxfps 10 $dops
+bltTest $bltgr -minredrawinterval 200 $dops
 bltTest $bltgr -plotbackground cyan $dops
 bltTest $bltgr -plotborderwidth 50 $dops
 bltTest $bltgr -plotpadx 50 $dops
 bltTest $bltgr -plotpady 50 $dops
 bltTest $bltgr -plotrelief groove $dops
+bltTest $bltgr -progressive 8 $dops
 bltTest $bltgr -relief groove $dops
 bltTest $bltgr -rightmargin 50 $dops
 bltTest $bltgr -rm 50 $dops
+bltTest $bltgr -stats yes $dops
 #bltTest $bltgr -searchhalo $dops
 #bltTest $bltgr -searchmode $dops
 #bltTest $bltgr -searchalong $dops
@@ -62,8 +67,12 @@ bltCmd $bltgr configure -background cyan
 #bltCmd $bltgr invtransform
 ##bltCmd $bltgr legend
 ##bltCmd $bltgr marker
+bltCmd $bltgr memory
 ##bltCmd $bltgr pen
 #bltCmd $bltgr postscript output foo.ps
+bltCmd $bltgr redraw
+bltCmd $bltgr stats
+bltCmd $bltgr stats -reset
 #bltCmd $bltgr transform
 ##bltCmd $bltgr x2axis
 ##bltCmd $bltgr xaxis